@@ -0,0 +1,119 @@
+/**
+ * @file EvaluadorBitSliced.cpp
+ * @brief Implementación del evaluador bit-sliced y de la verificación de equivalencia.
+ */
+#include <bits/stdc++.h>
+#include "EvaluadorBitSliced.h"
+#include "mintermino.h"
+using namespace std;
+
+/**
+ * @brief Patrones de las 6 variables menos significativas dentro de una palabra de 64 asignaciones.
+ *
+ * El bit i de PATRONES_VARIABLE[b] está encendido si la asignación i tiene encendido el bit b.
+ */
+static const uint64_t PATRONES_VARIABLE[6]={
+    0xAAAAAAAAAAAAAAAAULL,
+    0xCCCCCCCCCCCCCCCCULL,
+    0xF0F0F0F0F0F0F0F0ULL,
+    0xFF00FF00FF00FF00ULL,
+    0xFFFF0000FFFF0000ULL,
+    0xFFFFFFFF00000000ULL
+};
+
+/**
+ * @brief Compila los implicantes seleccionados en cubos valor/máscara.
+ *
+ * La forma binaria se lee con el primer carácter como bit más significativo, igual que en `formacionMinterminos`.
+ *
+ * @param[in] minterminosNoUsados Vector con los implicantes primos.
+ * @param[in] indices Índices de los implicantes que forman la expresión final.
+ * @param NUM_BITS Número de bits de los mintérminos.
+ * @return evaluadorBitSliced Evaluador listo para usarse.
+ */
+evaluadorBitSliced compilacionEvaluador(const vector<mintermino> &minterminosNoUsados, const vector<int> &indices, const int NUM_BITS){
+
+    evaluadorBitSliced evaluador;
+    evaluador.NUM_BITS=NUM_BITS;
+    evaluador.mascaraValida=(NUM_BITS>=6) ? ~0ULL : ((1ULL<<(1<<NUM_BITS))-1);
+
+    for(int indice:indices){
+        const string &formaBinaria=minterminosNoUsados[indice].formaBinaria;
+
+        cubo cuboCompilado;
+        cuboCompilado.valor=0;
+        cuboCompilado.mascara=0;
+        for(int l=0; l<NUM_BITS; l++){
+            uint64_t bit=1ULL<<(NUM_BITS-1-l);
+            if(formaBinaria[l]=='1') {cuboCompilado.valor|=bit; cuboCompilado.mascara|=bit;}
+            else if(formaBinaria[l]=='0') cuboCompilado.mascara|=bit;
+        }
+
+        //Las variables bajas se resuelven una sola vez aquí, las altas se comparan contra el índice del bloque
+        cuboCompilado.patronBajo=~0ULL;
+        for(int b=0; b<min(NUM_BITS, 6); b++){
+            if(!((cuboCompilado.mascara>>b)&1)) continue;
+            cuboCompilado.patronBajo&=((cuboCompilado.valor>>b)&1) ? PATRONES_VARIABLE[b] : ~PATRONES_VARIABLE[b];
+        }
+
+        evaluador.cubos.push_back(cuboCompilado);
+    }
+    return evaluador;
+}
+
+/**
+ * @brief Evalúa un bloque de 64 asignaciones consecutivas.
+ *
+ * Un cubo contribuye con su patrón bajo únicamente si sus variables altas coinciden con el índice del bloque.
+ *
+ * @param[in] evaluador Evaluador compilado.
+ * @param bloque Índice del bloque.
+ * @return uint64_t Resultados de las 64 asignaciones del bloque.
+ */
+uint64_t evaluacionBloque(const evaluadorBitSliced &evaluador, uint64_t bloque){
+
+    uint64_t resultado=0;
+    for(const cubo &c:evaluador.cubos){
+        if(((bloque<<6)&c.mascara&~63ULL)==(c.valor&~63ULL)) resultado|=c.patronBajo;
+    }
+    return resultado&evaluador.mascaraValida;
+}
+
+/**
+ * @brief Evalúa la función en una sola asignación.
+ *
+ * @param[in] evaluador Evaluador compilado.
+ * @param asignacion Valor de las variables.
+ * @return bool Valor de la función.
+ */
+bool evaluacionAsignacion(const evaluadorBitSliced &evaluador, uint64_t asignacion){
+
+    for(const cubo &c:evaluador.cubos){
+        if((asignacion&c.mascara)==c.valor) return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Verifica que la expresión final coincida con los mintérminos de entrada en todas las asignaciones.
+ *
+ * @param[in] evaluador Evaluador compilado.
+ * @param[in] minterminos Vector con los mintérminos originales de entrada.
+ * @return long long Primera asignación en la que difieren, o -1 si son equivalentes.
+ */
+long long verificacionEquivalencia(const evaluadorBitSliced &evaluador, const vector<int> &minterminos){
+
+    const uint64_t NUMERO_BLOQUES=(evaluador.NUM_BITS>6) ? (1ULL<<(evaluador.NUM_BITS-6)) : 1;
+
+    //Conjunto ON como mapa de bits, una palabra por bloque
+    vector<uint64_t> conjuntoOn(NUMERO_BLOQUES, 0);
+    for(int minterm:minterminos){
+        conjuntoOn[minterm>>6]|=1ULL<<(minterm&63);
+    }
+
+    for(uint64_t bloque=0; bloque<NUMERO_BLOQUES; bloque++){
+        uint64_t diferencia=evaluacionBloque(evaluador, bloque)^conjuntoOn[bloque];
+        if(diferencia) return (long long)((bloque<<6)+__builtin_ctzll(diferencia));
+    }
+    return -1;
+}
@@ -0,0 +1,101 @@
+/**
+ * @file EvaluadorBitSliced.h
+ * @brief Evaluador bit-sliced de la expresión booleana final y verificación de equivalencia contra los mintérminos.
+ *
+ * Los implicantes seleccionados se compilan en cubos (valor/máscara) y se evalúan 64 asignaciones de entrada a la vez,
+ * una por cada bit de una palabra de 64 bits. Las 6 variables menos significativas varían dentro de la palabra y las
+ * demás quedan fijas por el índice del bloque, de modo que cada cubo aporta un patrón precalculado o nada.
+ */
+
+#ifndef EVALUADOR_BIT_SLICED_H
+#define EVALUADOR_BIT_SLICED_H
+
+#include <vector>
+#include <cstdint>
+#include "mintermino.h"
+
+/**
+ * @struct cubo
+ * @brief Implicante compilado para la evaluación bit-sliced.
+ *
+ * Una asignación x está cubierta si (x & mascara) == valor.
+ */
+struct cubo {
+    /**
+     * @brief Bits que deben estar encendidos (posiciones con '1' en la forma binaria).
+     */
+    uint64_t valor;
+
+    /**
+     * @brief Bits que importan para el cubo (posiciones con '0' o '1', los '_' quedan fuera).
+     */
+    uint64_t mascara;
+
+    /**
+     * @brief Patrón de 64 bits que produce el cubo sobre las 6 variables menos significativas.
+     */
+    uint64_t patronBajo;
+};
+
+/**
+ * @struct evaluadorBitSliced
+ * @brief Expresión booleana final compilada para evaluarse por bloques de 64 asignaciones.
+ */
+struct evaluadorBitSliced {
+    /**
+     * @brief Número de variables de la función.
+     */
+    int NUM_BITS;
+
+    /**
+     * @brief Cubos de los implicantes seleccionados.
+     */
+    std::vector<cubo> cubos;
+
+    /**
+     * @brief Bits válidos de cada bloque (menos de 64 cuando NUM_BITS < 6).
+     */
+    uint64_t mascaraValida;
+};
+
+/**
+ * @brief Compila los implicantes seleccionados en un evaluador bit-sliced.
+ *
+ * @param[in] minterminosNoUsados Vector con los implicantes primos.
+ * @param[in] indices Índices de los implicantes que forman la expresión final.
+ * @param NUM_BITS Número de bits de los mintérminos.
+ * @return evaluadorBitSliced Evaluador listo para usarse.
+ */
+evaluadorBitSliced compilacionEvaluador(const std::vector<mintermino>&, const std::vector<int>&, const int);
+
+/**
+ * @brief Evalúa un bloque de 64 asignaciones consecutivas.
+ *
+ * @param[in] evaluador Evaluador compilado.
+ * @param bloque Índice del bloque, cubre las asignaciones [64*bloque, 64*bloque+63].
+ * @return uint64_t Palabra en la que el bit i es el valor de la función en la asignación 64*bloque+i.
+ */
+uint64_t evaluacionBloque(const evaluadorBitSliced&, uint64_t);
+
+/**
+ * @brief Evalúa la función en una sola asignación.
+ *
+ * @param[in] evaluador Evaluador compilado.
+ * @param asignacion Valor de las variables, con la misma numeración que los mintérminos.
+ * @return bool Valor de la función.
+ */
+bool evaluacionAsignacion(const evaluadorBitSliced&, uint64_t);
+
+/**
+ * @brief Verifica de forma exhaustiva que la expresión final coincida con los mintérminos de entrada.
+ *
+ * Construye el conjunto ON como mapa de bits y lo compara palabra por palabra con la salida del evaluador,
+ * recorriendo las 2^NUM_BITS asignaciones en bloques de 64.
+ *
+ * @param[in] evaluador Evaluador compilado.
+ * @param[in] minterminos Vector con los mintérminos originales de entrada.
+ * @return long long Primera asignación en la que difieren, o -1 si son equivalentes.
+ */
+long long verificacionEquivalencia(const evaluadorBitSliced&, const std::vector<int>&);
+
+#endif
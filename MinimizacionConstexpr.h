@@ -0,0 +1,247 @@
+/**
+ * @file MinimizacionConstexpr.h
+ * @brief Variante constexpr y sin memoria dinámica del método de Quine-McCluskey.
+ *
+ * Reproduce en tiempo de compilación los pasos de `formacionMinterminos`, `clasificacionMinterminos` y
+ * `simplificacionTablaFinal`, con todos los arreglos dimensionados por parámetros de plantilla. Sirve para
+ * incrustar funciones de decodificación fijas sin tener que ejecutar `programa` y copiar su salida.
+ *
+ * Ejemplo de uso:
+ * ```
+ * constexpr auto f = minimizacion<4>({0, 4, 8, 5, 12, 11, 7, 15});
+ * bool salida = evaluacionDesplegada<f>(entrada);
+ * ```
+ *
+ * @note Requiere C++17. Si la función tiene más implicantes primos que MAX_PRIMOS la evaluación constexpr falla
+ * y el error aparece al compilar.
+ */
+
+#ifndef MINIMIZACION_CONSTEXPR_H
+#define MINIMIZACION_CONSTEXPR_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * @struct coberturaConstexpr
+ * @brief Expresión booleana mínima calculada en tiempo de compilación.
+ *
+ * Cada cubo i cubre la asignación x si (x & mascara[i]) == valor[i], con la misma numeración de variables que los
+ * mintérminos (el bit NUM_BITS-1 es la primera variable).
+ *
+ * @tparam NUM_BITS Número de variables de la función.
+ * @tparam MAX_PRIMOS Cantidad máxima de implicantes primos que se pueden almacenar.
+ */
+template<int NUM_BITS, int MAX_PRIMOS>
+struct coberturaConstexpr {
+    /**
+     * @brief Bits que deben estar encendidos en cada cubo.
+     */
+    std::array<uint32_t, MAX_PRIMOS> valor{};
+
+    /**
+     * @brief Bits que importan en cada cubo, las variables eliminadas quedan en 0.
+     */
+    std::array<uint32_t, MAX_PRIMOS> mascara{};
+
+    /**
+     * @brief Número de cubos que forman la expresión final.
+     */
+    int numeroCubos=0;
+
+    /**
+     * @brief Evalúa la función en una asignación.
+     * @param asignacion Valor de las variables.
+     * @return bool Valor de la función.
+     */
+    constexpr bool operator()(uint32_t asignacion) const {
+        for(int i=0; i<numeroCubos; i++){
+            if((asignacion&mascara[i])==valor[i]) return true;
+        }
+        return false;
+    }
+};
+
+namespace detalleMinimizacion {
+
+/**
+ * @brief Cubo de trabajo usado durante las combinaciones.
+ */
+struct cuboTrabajo {
+    uint32_t valor;
+    uint32_t guiones;
+    bool uso;
+};
+
+/**
+ * @brief Cantidad máxima de cubos con la misma cantidad de guiones, max_k C(n,k)*2^(n-k).
+ */
+constexpr int maximoCubosPorColumna(int n){
+    int maximo=0;
+    for(int k=0; k<=n; k++){
+        long long combinaciones=1;
+        for(int i=0; i<k; i++) combinaciones=combinaciones*(n-i)/(i+1);
+        long long cubos=combinaciones<<(n-k);
+        if(cubos>maximo) maximo=(int)cubos;
+    }
+    return maximo;
+}
+
+/**
+ * @brief Indica si todos los puntos del cubo pertenecen al conjunto ON.
+ */
+template<std::size_t PALABRAS>
+constexpr bool esImplicante(const std::array<uint64_t, PALABRAS> &conjuntoOn, uint32_t valor, uint32_t guiones){
+    for(uint32_t s=guiones;; s=(s-1)&guiones){
+        uint32_t punto=valor|s;
+        if(!((conjuntoOn[punto>>6]>>(punto&63))&1)) return false;
+        if(s==0) break;
+    }
+    return true;
+}
+
+/**
+ * @brief Expande la cobertura en una secuencia fija de comparaciones unidas con OR.
+ */
+template<const auto &COBERTURA, std::size_t... I>
+constexpr bool evaluacionIndices(uint32_t asignacion, std::index_sequence<I...>){
+    return (false || ... || ((asignacion&COBERTURA.mascara[I])==COBERTURA.valor[I]));
+}
+
+}
+
+/**
+ * @brief Minimiza en tiempo de compilación la función dada por sus mintérminos.
+ *
+ * Las combinaciones se hacen por columnas como en `clasificacionMinterminos`: cada cubo con k guiones se intenta
+ * combinar en cada variable que no sea guion, y los que no se combinan son implicantes primos. Cada cubo de la
+ * columna siguiente se genera solo desde la variable de guion más alta, lo que evita los repetidos sin buscarlos.
+ * La selección sigue a `simplificacionTablaFinal`: primero los esenciales y después el que cubra más mintérminos
+ * pendientes hasta completar la cobertura.
+ *
+ * @tparam NUM_BITS Número de variables de la función.
+ * @tparam MAX_PRIMOS Cantidad máxima de implicantes primos.
+ * @param[in] minterminos Arreglo con los mintérminos de la función.
+ * @return coberturaConstexpr<NUM_BITS, MAX_PRIMOS> Cubos de la expresión final.
+ */
+template<int NUM_BITS, int MAX_PRIMOS=64, std::size_t N>
+constexpr coberturaConstexpr<NUM_BITS, MAX_PRIMOS> minimizacion(const int (&minterminos)[N]){
+
+    static_assert(NUM_BITS>=1 && NUM_BITS<=12, "minimizacion admite de 1 a 12 variables");
+    constexpr int NUMERO_ASIGNACIONES=1<<NUM_BITS;
+    constexpr std::size_t PALABRAS=(NUMERO_ASIGNACIONES+63)/64;
+    constexpr int MAXIMO_COLUMNA=detalleMinimizacion::maximoCubosPorColumna(NUM_BITS);
+
+    //Conjunto ON como mapa de bits, también elimina los mintérminos repetidos
+    std::array<uint64_t, PALABRAS> conjuntoOn{};
+    std::array<uint32_t, NUMERO_ASIGNACIONES> minterminosUnicos{};
+    int NUMERO_MINTERMINOS=0;
+    for(std::size_t i=0; i<N; i++){
+        if(minterminos[i]<0 || minterminos[i]>=NUMERO_ASIGNACIONES) throw std::out_of_range("mintermino fuera del rango de NUM_BITS");
+        uint32_t minterm=(uint32_t)minterminos[i];
+        if((conjuntoOn[minterm>>6]>>(minterm&63))&1) continue;
+        conjuntoOn[minterm>>6]|=1ULL<<(minterm&63);
+        minterminosUnicos[NUMERO_MINTERMINOS++]=minterm;
+    }
+
+    //Columna 0 con los mintérminos, después cada columna agrega un guion
+    std::array<detalleMinimizacion::cuboTrabajo, MAXIMO_COLUMNA> columnaActual{}, columnaSiguiente{};
+    int tamanoActual=0;
+    for(int i=0; i<NUMERO_MINTERMINOS; i++) columnaActual[tamanoActual++]={minterminosUnicos[i], 0, false};
+
+    std::array<uint32_t, MAX_PRIMOS> primosValor{}, primosGuiones{};
+    int numeroPrimos=0;
+
+    while(tamanoActual>0){
+        int tamanoSiguiente=0;
+        for(int j=0; j<tamanoActual; j++){
+            detalleMinimizacion::cuboTrabajo &c=columnaActual[j];
+            for(int v=0; v<NUM_BITS; v++){
+                uint32_t bit=1u<<v;
+                if(c.guiones&bit) continue;
+                if(!detalleMinimizacion::esImplicante(conjuntoOn, c.valor^bit, c.guiones)) continue;
+
+                c.uso=true;
+                if(!(c.valor&bit) && bit>c.guiones) columnaSiguiente[tamanoSiguiente++]={c.valor, c.guiones|bit, false};
+            }
+            if(!c.uso){
+                if(numeroPrimos==MAX_PRIMOS) throw std::length_error("MAX_PRIMOS insuficiente para la funcion");
+                primosValor[numeroPrimos]=c.valor;
+                primosGuiones[numeroPrimos]=c.guiones;
+                numeroPrimos++;
+            }
+        }
+        for(int j=0; j<tamanoSiguiente; j++) columnaActual[j]=columnaSiguiente[j];
+        tamanoActual=tamanoSiguiente;
+    }
+
+    //Tabla de cobertura: primo i cubre al mintérmino j
+    auto cubre=[&](int i, int j){
+        return (minterminosUnicos[j]&~primosGuiones[i])==primosValor[i];
+    };
+
+    std::array<bool, NUMERO_ASIGNACIONES> minterminosExpresados{};
+    std::array<bool, MAX_PRIMOS> primoSeleccionado{};
+    int numeroMinterminosExpresados=0;
+
+    coberturaConstexpr<NUM_BITS, MAX_PRIMOS> cobertura;
+    auto seleccion=[&](int i){
+        primoSeleccionado[i]=true;
+        cobertura.valor[cobertura.numeroCubos]=primosValor[i];
+        cobertura.mascara[cobertura.numeroCubos]=(NUMERO_ASIGNACIONES-1)&~primosGuiones[i];
+        cobertura.numeroCubos++;
+        for(int j=0; j<NUMERO_MINTERMINOS; j++){
+            if(cubre(i, j) && !minterminosExpresados[j]){
+                minterminosExpresados[j]=true;
+                numeroMinterminosExpresados++;
+            }
+        }
+    };
+
+    //Implicantes esenciales (mintérminos expresados por un solo primo)
+    for(int j=0; j<NUMERO_MINTERMINOS; j++){
+        int numXsEnColumna=0, row=0;
+        for(int i=0; i<numeroPrimos; i++){
+            if(cubre(i, j)) {numXsEnColumna++; row=i;}
+        }
+        if(numXsEnColumna==1 && !primoSeleccionado[row]) seleccion(row);
+    }
+
+    //Descarte final por cantidad máxima de mintérminos pendientes
+    while(numeroMinterminosExpresados<NUMERO_MINTERMINOS){
+        int rowMaxMinterminos=0, numMaxMinterminos=0;
+        for(int i=0; i<numeroPrimos; i++){
+            if(primoSeleccionado[i]) continue;
+            int numMinterminosUnicos=0;
+            for(int j=0; j<NUMERO_MINTERMINOS; j++){
+                if(cubre(i, j) && !minterminosExpresados[j]) numMinterminosUnicos++;
+            }
+            if(numMinterminosUnicos>numMaxMinterminos){
+                numMaxMinterminos=numMinterminosUnicos;
+                rowMaxMinterminos=i;
+            }
+        }
+        seleccion(rowMaxMinterminos);
+    }
+    return cobertura;
+}
+
+/**
+ * @brief Evalúa una cobertura constexpr desplegada en comparaciones AND/OR fijas.
+ *
+ * La cantidad de cubos se conoce al compilar, por lo que no queda ningún ciclo en el código generado.
+ * La cobertura debe tener almacenamiento estático (por ejemplo `constexpr` a nivel de namespace o `static constexpr`).
+ *
+ * @tparam COBERTURA Cobertura obtenida con `minimizacion`.
+ * @param asignacion Valor de las variables.
+ * @return bool Valor de la función.
+ */
+template<const auto &COBERTURA>
+constexpr bool evaluacionDesplegada(uint32_t asignacion){
+    return detalleMinimizacion::evaluacionIndices<COBERTURA>(asignacion, std::make_index_sequence<COBERTURA.numeroCubos>{});
+}
+
+#endif
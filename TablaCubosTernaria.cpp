@@ -0,0 +1,164 @@
+/**
+ * @file TablaCubosTernaria.cpp
+ * @brief Implementación de la generación de implicantes mediante la tabla densa de cubos ternarios.
+ */
+#include <bits/stdc++.h>
+#include "TablaCubosTernaria.h"
+#include "mintermino.h"
+using namespace std;
+
+/**
+ * @brief Variables guardadas dentro de cada palabra (base 4, 4^3 = 64 bits).
+ */
+static const int VARIABLES_POR_PALABRA=3;
+
+/**
+ * @brief Llena la tabla de clasificación global usando la tabla densa de cubos ternarios.
+ *
+ * Primero se marcan los mintérminos, después un barrido por variable forma el cubo con guion en v como el AND de
+ * sus hijos con 0 y 1 en v. Un segundo barrido marca como absorbidos a los hijos de cada cubo presente, y los
+ * cubos presentes que no quedan absorbidos son los implicantes primos.
+ *
+ * @param NUM_BITS Número de bits de los mintérminos.
+ * @param[in,out] clasificacionGlobalMinterminos Estructura global que almacena las combinaciones por iteración.
+ * @return int Número total de columnas de combinaciones generadas.
+ */
+int clasificacionMinterminosTernaria(int NUM_BITS, vector<vector<mintermino>> &clasificacionGlobalMinterminos){
+
+    const int VARIABLES_BAJAS=min(NUM_BITS, VARIABLES_POR_PALABRA);
+
+    //Potencias de 3 para las variables altas (zancada en palabras) y de 4 para las bajas (desplazamiento en bits)
+    vector<size_t> potenciaTres(NUM_BITS+1, 1);
+    for(int v=VARIABLES_BAJAS+1; v<=NUM_BITS; v++) potenciaTres[v]=potenciaTres[v-1]*3;
+    const size_t NUMERO_PALABRAS=potenciaTres[NUM_BITS];
+    const int potenciaCuatro[VARIABLES_POR_PALABRA]={1, 4, 16};
+
+    //Posiciones dentro de la palabra cuyo dígito v vale 2 (guion)
+    uint64_t mascaraGuion[VARIABLES_POR_PALABRA]={0, 0, 0};
+    for(int v=0; v<VARIABLES_POR_PALABRA; v++){
+        for(int p=0; p<64; p++){
+            if((p/potenciaCuatro[v])%4==2) mascaraGuion[v]|=1ULL<<p;
+        }
+    }
+
+    vector<uint64_t> tabla(NUMERO_PALABRAS, 0), absorbidos(NUMERO_PALABRAS, 0);
+
+    //Posición de un mintérmino (todas sus variables en 0 o 1) dentro de la tabla
+    auto posicionMintermino=[&](int minterm, size_t &palabra, int &bit){
+        palabra=0; bit=0;
+        for(int v=0; v<NUM_BITS; v++){
+            if(!((minterm>>v)&1)) continue;
+            if(v<VARIABLES_BAJAS) bit+=potenciaCuatro[v];
+            else palabra+=potenciaTres[v];
+        }
+    };
+
+    for(mintermino &minterm:clasificacionGlobalMinterminos[0]){
+        size_t palabra; int bit;
+        posicionMintermino(stoi(minterm.estructuraMintermino), palabra, bit);
+        tabla[palabra]|=1ULL<<bit;
+    }
+
+    //Barrido por variable: cubo con guion en v = hijo con 0 en v AND hijo con 1 en v
+    for(int v=0; v<VARIABLES_BAJAS; v++){
+        const int d=potenciaCuatro[v];
+        for(size_t i=0; i<NUMERO_PALABRAS; i++){
+            tabla[i]|=(tabla[i]<<(2*d))&(tabla[i]<<d)&mascaraGuion[v];
+        }
+    }
+    for(int v=VARIABLES_BAJAS; v<NUM_BITS; v++){
+        const size_t zancada=potenciaTres[v];
+        for(size_t base=0; base<NUMERO_PALABRAS; base+=3*zancada){
+            uint64_t *hijoCero=&tabla[base], *hijoUno=&tabla[base+zancada], *guion=&tabla[base+2*zancada];
+            for(size_t i=0; i<zancada; i++) guion[i]=hijoCero[i]&hijoUno[i];
+        }
+    }
+
+    //Cada cubo presente con guion en v absorbe a sus dos hijos
+    for(int v=0; v<VARIABLES_BAJAS; v++){
+        const int d=potenciaCuatro[v];
+        for(size_t i=0; i<NUMERO_PALABRAS; i++){
+            uint64_t guion=tabla[i]&mascaraGuion[v];
+            absorbidos[i]|=(guion>>(2*d))|(guion>>d);
+        }
+    }
+    for(int v=VARIABLES_BAJAS; v<NUM_BITS; v++){
+        const size_t zancada=potenciaTres[v];
+        for(size_t base=0; base<NUMERO_PALABRAS; base+=3*zancada){
+            uint64_t *hijoCero=&absorbidos[base], *hijoUno=&absorbidos[base+zancada];
+            const uint64_t *guion=&tabla[base+2*zancada];
+            for(size_t i=0; i<zancada; i++){
+                hijoCero[i]|=guion[i];
+                hijoUno[i]|=guion[i];
+            }
+        }
+    }
+
+    //Los mintérminos de la iteración 0 se usaron si quedaron absorbidos
+    for(mintermino &minterm:clasificacionGlobalMinterminos[0]){
+        size_t palabra; int bit;
+        posicionMintermino(stoi(minterm.estructuraMintermino), palabra, bit);
+        minterm.uso=(absorbidos[palabra]>>bit)&1;
+    }
+
+    //Lectura de los cubos con al menos un guion, agrupados según su cantidad de guiones
+    vector<vector<pair<vector<int>, mintermino>>> cubosPorColumna(NUM_BITS+1);
+    for(size_t palabra=0; palabra<NUMERO_PALABRAS; palabra++){
+        uint64_t restantes=tabla[palabra];
+        while(restantes){
+            const int bit=__builtin_ctzll(restantes);
+            restantes&=restantes-1;
+
+            //Decodificación de los dígitos del cubo en valor y guiones
+            int valor=0, guiones=0;
+            size_t indiceAlto=palabra;
+            for(int v=0; v<NUM_BITS; v++){
+                int digito=(v<VARIABLES_BAJAS) ? (bit/potenciaCuatro[v])%4 : (int)(indiceAlto%3);
+                if(v>=VARIABLES_BAJAS) indiceAlto/=3;
+                if(digito==1) valor|=1<<v;
+                else if(digito==2) guiones|=1<<v;
+            }
+            if(!guiones) continue;
+
+            string formaBinaria="", expresionBool="";
+            for(int l=0; l<NUM_BITS; l++){
+                int v=NUM_BITS-1-l;
+                if((guiones>>v)&1) formaBinaria.push_back('_');
+                else if((valor>>v)&1) {formaBinaria.push_back('1'); expresionBool.push_back((char)('z'-NUM_BITS+(l+1)));}
+                else {formaBinaria.push_back('0'); expresionBool.push_back((char)('z'-NUM_BITS+(l+1))); expresionBool.push_back('\'');}
+            }
+
+            //Mintérminos cubiertos en orden creciente (subconjuntos de los guiones en orden creciente)
+            vector<int> cubiertos;
+            string estructura="";
+            for(int s=0;; s=(s-guiones)&guiones){
+                if(!estructura.empty()) estructura.push_back(',');
+                estructura+=to_string(valor|s);
+                cubiertos.push_back(valor|s);
+                if(s==guiones) break;
+            }
+
+            mintermino minterminoCombinado;
+            minterminoCombinado.formaBinaria=formaBinaria;
+            minterminoCombinado.estructuraMintermino=estructura;
+            minterminoCombinado.uso=(absorbidos[palabra]>>bit)&1;
+            minterminoCombinado.expresionBooleana=expresionBool;
+
+            cubosPorColumna[__builtin_popcount(guiones)].push_back({cubiertos, minterminoCombinado});
+        }
+    }
+
+    //Mismo orden que la combinación por pares: creciente según los mintérminos cubiertos
+    for(int i=1; i<=NUM_BITS; i++){
+        sort(cubosPorColumna[i].begin(), cubosPorColumna[i].end(), [](const pair<vector<int>, mintermino> &a, const pair<vector<int>, mintermino> &b){
+            return a.first<b.first;
+        });
+        for(pair<vector<int>, mintermino> &cubo:cubosPorColumna[i]) clasificacionGlobalMinterminos[i].push_back(cubo.second);
+    }
+
+    int totalColumns=0;
+    for(vector<mintermino> &columna:clasificacionGlobalMinterminos){
+        if(!columna.empty()) totalColumns++;
+    }
+    return totalColumns;
+}
@@ -0,0 +1,37 @@
+/**
+ * @file TablaCubosTernaria.h
+ * @brief Generación de implicantes con una tabla densa sobre el espacio ternario de cubos.
+ *
+ * Para pocas variables cada implicante posible (cada variable en 0, 1 o _) tiene una posición fija en una tabla de
+ * 3^n entradas. La tabla se llena con un barrido por variable que obtiene el cubo con guion en v a partir de sus dos
+ * hijos, con operaciones sobre palabras de 64 bits, sin comparar mintérminos por pares.
+ *
+ * Distribución de la tabla: las 3 variables menos significativas se guardan dentro de cada palabra en base 4
+ * (4^3 = 64 bits, el dígito 3 no se usa) y las demás variables indexan las palabras en base 3.
+ */
+
+#ifndef TABLA_CUBOS_TERNARIA_H
+#define TABLA_CUBOS_TERNARIA_H
+
+#include <vector>
+#include "mintermino.h"
+
+/**
+ * @brief Número máximo de bits para el cual `clasificacionMinterminos` utiliza la tabla ternaria.
+ */
+const int LIMITE_BITS_TABLA_TERNARIA=16;
+
+/**
+ * @brief Llena la tabla de clasificación global usando la tabla densa de cubos ternarios.
+ *
+ * Toma los mintérminos de la iteración 0 y almacena en la iteración k todos los implicantes con k guiones,
+ * marcando como usados los que quedan absorbidos por un implicante con un guion más. Deja la tabla con la misma
+ * forma que la combinación por pares, por lo que la impresión y la tabla final no cambian.
+ *
+ * @param NUM_BITS Número de bits de los mintérminos, a lo más LIMITE_BITS_TABLA_TERNARIA.
+ * @param[in,out] clasificacionGlobalMinterminos Estructura global que almacena las combinaciones por iteración.
+ * @return int Número total de columnas de combinaciones generadas.
+ */
+int clasificacionMinterminosTernaria(int, std::vector<std::vector<mintermino>>&);
+
+#endif
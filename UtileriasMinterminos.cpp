@@ -4,6 +4,7 @@
  */
 #include <bits/stdc++.h>
 #include "UtileriasMinterminos.h"
+#include "TablaCubosTernaria.h"
 #include "mintermino.h"
 using namespace std;
 
@@ -97,7 +98,8 @@ int formacionMinterminos(int MINTERMINO_MAXIMO, vector<int> &minterminos, vector
  * @brief Clasifica los mintérminos en múltiples iteraciones, combinando aquellos que difieren en un solo bit.
  * 
  * Genera nuevas combinaciones de mintérminos a partir de la iteración 1 en adelante, 
- * siguiendo el método de Quine-McCluskey.
+ * siguiendo el método de Quine-McCluskey. Con a lo más LIMITE_BITS_TABLA_TERNARIA bits las combinaciones
+ * se obtienen de la tabla densa de cubos ternarios en lugar de comparar los mintérminos por pares.
  * 
  * @param NUM_BITS Número de bits de los mintérminos.
  * @param[in,out] clasificacionGlobalMinterminos Estructura global que almacena las combinaciones por iteración.
@@ -106,6 +108,9 @@ int formacionMinterminos(int MINTERMINO_MAXIMO, vector<int> &minterminos, vector
 
 int clasificacionMinterminos(int NUM_BITS, vector<vector<mintermino>>&clasificacionGlobalMinterminos){
 
+    //Para pocas variables la tabla ternaria genera todas las combinaciones sin comparar por pares
+    if(NUM_BITS<=LIMITE_BITS_TABLA_TERNARIA) return clasificacionMinterminosTernaria(NUM_BITS, clasificacionGlobalMinterminos);
+
     int totalColumns=0;
     bool hasElements=true;
 
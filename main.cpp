@@ -12,7 +12,7 @@
  * 
  * Para compilar:
  * ```
- * g++ main.cpp UtileriasMinterminos.cpp -o programa
+ * g++ main.cpp UtileriasMinterminos.cpp EvaluadorBitSliced.cpp TablaCubosTernaria.cpp -o programa
  * ./programa
  * ```
  * 
@@ -23,6 +23,7 @@
 #include <bits/stdc++.h>
 #include <iomanip>
 #include "UtileriasMinterminos.h"
+#include "EvaluadorBitSliced.h"
 #include "mintermino.h"
 
 using namespace std;
@@ -95,6 +96,12 @@ int main() {
         if(i!=indices.size()-1) cout<<" + ";
     }
     cout<<" \n"<<endl;
+
+    //Verificación exhaustiva de la expresión final contra los mintérminos de entrada
+    evaluadorBitSliced evaluador=compilacionEvaluador(minterminosNoUsados, indices, NUM_BITS);
+    long long asignacionDiferente=verificacionEquivalencia(evaluador, minterminos);
+    if(asignacionDiferente==-1) cout<<"    Verificacion de equivalencia: correcta\n"<<endl;
+    else cout<<"    Verificacion de equivalencia: incorrecta, difiere en la asignacion "<<asignacionDiferente<<"\n"<<endl;
     return 0;
 
 }